@@ -0,0 +1,70 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <vector>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include "Tetromino.h"
+
+// Одно игровое поле: стакан, активная фигура и счёт.
+// Используется и в одиночной игре, и в режиме против ботов
+struct Board {
+    std::vector<std::vector<sf::Color>> field;
+    Tetromino currentPiece;
+    float elapsedTime;
+    float delay;
+    int score;
+    bool isGameOver;
+    bool isGameWon;
+    bool isBot;
+    bool changed;                    // поле изменилось за последний update()
+    std::mt19937 gen;
+    std::vector<int> pendingGarbage; // колонки-дыры входящих строк мусора
+    int garbageToSend;               // исходящий мусор за текущий тик
+    int attackTarget;                // последний соперник, получивший мусор
+    int botTargetX;
+    int botRotations;
+    float botTimer;
+
+    Board(unsigned seed, bool isBot = false);
+    void reset();
+    void spawnPiece();
+    bool fits(const Tetromino& piece) const;
+    bool isValidPosition() const;
+    bool movePiece(int dx);
+    bool rotatePiece();
+    void softDrop();
+    void hardDrop();
+    void lockPiece();
+    int checkLines();
+    void applyGarbage();
+    void update(float deltaTime);
+    double evaluate(const Tetromino& piece) const;
+    void planBotMove();
+    void botStep();
+};
+
+// Пул потоков, продвигающий доски на один тик параллельно
+class BoardWorkers {
+private:
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::vector<Board>* boards = nullptr;
+    size_t workerCount = 1;
+    float deltaTime = 0;
+    unsigned generation = 0;
+    size_t running = 0;
+    bool stopping = false;
+
+    void advance(size_t worker);
+    void workerLoop(size_t worker, unsigned seen);
+
+public:
+    ~BoardWorkers();
+    void start(size_t boardCount);
+    void stop();
+    void step(std::vector<Board>& target, float dt);
+};
@@ -3,6 +3,7 @@
 #include <vector>
 #include <string>
 #include "Tetromino.h"
+#include "Board.h"
 #include "GameResult.h"
 
 const int CELL_SIZE = 30;
@@ -10,16 +11,15 @@ const int FIELD_WIDTH = 10;
 const int FIELD_HEIGHT = 20;
 const int WINDOW_WIDTH = FIELD_WIDTH * CELL_SIZE + 300;
 const int WINDOW_HEIGHT = FIELD_HEIGHT * CELL_SIZE;
+const int MIN_VERSUS_BOARDS = 2;
+const int MAX_VERSUS_BOARDS = 12;
+const float VERSUS_TICK = 1.0f / 60.0f;
 
 class Game {
 private:
     sf::RenderWindow window;
-    std::vector<std::vector<sf::Color>> field;
-    Tetromino currentPiece;
-    float elapsedTime;
-    float delay;
-    int score;
-    bool isGameOver, isGameWon, isGameFinished, showResults;
+    Board player;
+    bool isGameFinished, showResults;
     bool isPaused;
     std::vector<GameResult> bestResults;
     std::vector<std::string> menuItems;
@@ -29,8 +29,15 @@ private:
     sf::RectangleShape restartButton;
     sf::Text restartButtonText;
     sf::RectangleShape fieldBorder;
+    bool needsRedraw;
 
-    std::vector<Tetromino> pieces;
+    // Режим против ботов: доска 0 у игрока, остальные у ботов
+    bool inVersus, isVersusOver;
+    int versusBoardCount, versusWinner;
+    float versusAccumulator;
+    std::vector<Board> boards;
+    std::mt19937 garbageGen;
+    BoardWorkers workers;
 
     void loadResults();
     void saveResults();
@@ -38,11 +45,17 @@ private:
     void finishGame(const std::string& result);
     void initRestartButton();
     void initFieldBorder();
-    void spawnPiece();
-    bool isValidPosition();
-    void rotatePiece();
-    void lockPiece();
-    void checkLines();
+    void checkFinished();
+    void startVersus();
+    void leaveVersus();
+    int nextOpponent(int from);
+    bool exchangeGarbage();
+    void updateVersus(float deltaTime);
+    static void appendQuad(sf::VertexArray& vertices, float x, float y, float w, float h, sf::Color color);
+    static void appendBoard(sf::VertexArray& vertices, const Board& board, float left, float top, float cellSize);
+    bool isIdle() const;
+    bool waitEvent(sf::Event& event, sf::Time timeout);
+    void processEvent(const sf::Event& event);
 
 public:
     bool inMainMenu, showRating;
@@ -52,6 +65,8 @@ public:
     void update(float deltaTime);
     void renderMainMenu();
     void renderRating();
+    void renderVersus();
     void renderGame();
+    void run();
     bool isWindowOpen() const;
 };
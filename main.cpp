@@ -8,12 +8,19 @@
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 const int CELL_SIZE = 30;
 const int FIELD_WIDTH = 10;
 const int FIELD_HEIGHT = 20;
 const int WINDOW_WIDTH = FIELD_WIDTH * CELL_SIZE + 300;
 const int WINDOW_HEIGHT = FIELD_HEIGHT * CELL_SIZE;
+const int MIN_VERSUS_BOARDS = 2;
+const int MAX_VERSUS_BOARDS = 12;
+const float VERSUS_TICK = 1.0f / 60.0f;
 
 struct Tetromino {
     std::vector<std::vector<int>> shape;
@@ -27,9 +34,34 @@ struct GameResult {
     std::string result; // "ПОБЕДА" или "ПОРАЖЕНИЕ"
 };
 
-class Game {
-private:
-    sf::RenderWindow window;
+const std::vector<Tetromino> PIECES = {
+    { { {1, 1, 1, 1} }, sf::Color::Cyan, 0, 0 },
+    { { {1, 1}, {1, 1} }, sf::Color::Yellow, 0, 0 },
+    { { {0, 1, 0}, {1, 1, 1} }, sf::Color::Magenta, 0, 0 },
+    { { {1, 1, 0}, {0, 1, 1} }, sf::Color::Red, 0, 0 },
+    { { {0, 1, 1}, {1, 1, 0} }, sf::Color::Green, 0, 0 },
+    { { {1, 0, 0}, {1, 1, 1} }, sf::Color::Blue, 0, 0 },
+    { { {0, 0, 1}, {1, 1, 1} }, sf::Color(255, 165, 0), 0, 0 }
+};
+
+// Сколько строк мусора отправляется сопернику за 0..4 снятые линии
+const int GARBAGE_FOR_LINES[] = {0, 0, 1, 2, 4};
+const sf::Color GARBAGE_COLOR(100, 100, 100);
+const float BOT_MOVE_DELAY = 0.1f;
+
+std::vector<std::vector<int>> rotateShape(const std::vector<std::vector<int>>& shape) {
+    std::vector<std::vector<int>> rotated(shape[0].size(), std::vector<int>(shape.size()));
+    for (size_t i = 0; i < shape.size(); ++i) {
+        for (size_t j = 0; j < shape[i].size(); ++j) {
+            rotated[j][shape.size() - 1 - i] = shape[i][j];
+        }
+    }
+    return rotated;
+}
+
+// Одно игровое поле: стакан, активная фигура и счёт.
+// Используется и в одиночной игре, и в режиме против ботов
+struct Board {
     std::vector<std::vector<sf::Color>> field;
     Tetromino currentPiece;
     float elapsedTime;
@@ -37,6 +69,400 @@ private:
     int score;
     bool isGameOver;
     bool isGameWon;
+    bool isBot;
+    bool changed;                    // поле изменилось за последний update()
+    std::mt19937 gen;
+    std::vector<int> pendingGarbage; // колонки-дыры входящих строк мусора
+    int garbageToSend;               // исходящий мусор за текущий тик
+    int attackTarget;                // последний соперник, получивший мусор
+    int botTargetX;
+    int botRotations;
+    float botTimer;
+
+    Board(unsigned seed, bool isBot = false) : isBot(isBot), gen(seed), attackTarget(0) {
+        reset();
+    }
+
+    void reset() {
+        field = std::vector<std::vector<sf::Color>>(FIELD_HEIGHT, std::vector<sf::Color>(FIELD_WIDTH, sf::Color::Black));
+        elapsedTime = 0;
+        delay = 0.5f;
+        score = 0;
+        isGameOver = false;
+        isGameWon = false;
+        changed = true;
+        pendingGarbage.clear();
+        garbageToSend = 0;
+        botTargetX = 0;
+        botRotations = 0;
+        botTimer = 0;
+        spawnPiece();
+    }
+
+    void spawnPiece() {
+        std::uniform_int_distribution<> dist(0, PIECES.size() - 1);
+
+        currentPiece = PIECES[dist(gen)];
+        currentPiece.x = FIELD_WIDTH / 2 - currentPiece.shape[0].size() / 2;
+        currentPiece.y = 0;
+
+        // Проверка на проигрыш (не можем разместить новую фигуру)
+        if (!isValidPosition()) {
+            isGameOver = true;
+        }
+
+        // Проверка на победу (фигура выходит за верхнюю границу)
+        for (size_t i = 0; i < currentPiece.shape.size(); ++i) {
+            for (size_t j = 0; j < currentPiece.shape[i].size(); ++j) {
+                if (currentPiece.shape[i][j] == 0) continue;
+
+                int newY = currentPiece.y + i;
+                if (newY < 0) {
+                    isGameWon = true;
+                    return;
+                }
+            }
+        }
+
+        if (isBot && !isGameOver) {
+            planBotMove();
+        }
+    }
+
+    bool fits(const Tetromino& piece) const {
+        for (size_t i = 0; i < piece.shape.size(); ++i) {
+            for (size_t j = 0; j < piece.shape[i].size(); ++j) {
+                if (piece.shape[i][j] == 0) continue;
+
+                int newX = piece.x + j;
+                int newY = piece.y + i;
+
+                if (newX < 0 || newX >= FIELD_WIDTH || newY >= FIELD_HEIGHT) {
+                    return false;
+                }
+
+                if (newY >= 0 && field[newY][newX] != sf::Color::Black) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    bool isValidPosition() const {
+        return fits(currentPiece);
+    }
+
+    bool movePiece(int dx) {
+        currentPiece.x += dx;
+        if (!isValidPosition()) {
+            currentPiece.x -= dx;
+            return false;
+        }
+        return true;
+    }
+
+    bool rotatePiece() {
+        if (isGameOver || isGameWon) return false;
+
+        auto oldShape = currentPiece.shape;
+        currentPiece.shape = rotateShape(currentPiece.shape);
+
+        if (!isValidPosition()) {
+            currentPiece.shape = oldShape;
+            return false;
+        }
+        return true;
+    }
+
+    void softDrop() {
+        currentPiece.y++;
+        if (!isValidPosition()) {
+            currentPiece.y--;
+            lockPiece();
+        }
+    }
+
+    void hardDrop() {
+        while (isValidPosition()) {
+            currentPiece.y++;
+        }
+        currentPiece.y--;
+        lockPiece();
+    }
+
+    void lockPiece() {
+        for (size_t i = 0; i < currentPiece.shape.size(); ++i) {
+            for (size_t j = 0; j < currentPiece.shape[i].size(); ++j) {
+                if (currentPiece.shape[i][j] == 0) continue;
+
+                int fieldX = currentPiece.x + j;
+                int fieldY = currentPiece.y + i;
+
+                if (fieldY >= 0) {
+                    field[fieldY][fieldX] = currentPiece.color;
+                }
+            }
+        }
+
+        // Снятые линии сначала гасят входящий мусор, остаток уходит сопернику
+        int garbage = GARBAGE_FOR_LINES[std::min(checkLines(), 4)];
+        while (garbage > 0 && !pendingGarbage.empty()) {
+            pendingGarbage.pop_back();
+            --garbage;
+        }
+        garbageToSend += garbage;
+
+        applyGarbage();
+        spawnPiece();
+    }
+
+    int checkLines() {
+        int lines = 0;
+        for (int i = FIELD_HEIGHT - 1; i >= 0; --i) {
+            bool lineComplete = true;
+            for (int j = 0; j < FIELD_WIDTH; ++j) {
+                if (field[i][j] == sf::Color::Black) {
+                    lineComplete = false;
+                    break;
+                }
+            }
+
+            if (lineComplete) {
+                field.erase(field.begin() + i);
+                field.insert(field.begin(), std::vector<sf::Color>(FIELD_WIDTH, sf::Color::Black));
+                score += 100;
+                delay *= 0.95f;
+                ++lines;
+                ++i; // на место снятой строки опустилась верхняя, проверяем её ещё раз
+            }
+        }
+        return lines;
+    }
+
+    // Поднимаем стакан на накопленные строки мусора
+    void applyGarbage() {
+        for (int hole : pendingGarbage) {
+            for (const auto& cell : field.front()) {
+                if (cell != sf::Color::Black) {
+                    isGameOver = true;
+                }
+            }
+            field.erase(field.begin());
+            field.push_back(std::vector<sf::Color>(FIELD_WIDTH, GARBAGE_COLOR));
+            field.back()[hole] = sf::Color::Black;
+        }
+        pendingGarbage.clear();
+    }
+
+    void update(float deltaTime) {
+        changed = false;
+        if (isGameOver || isGameWon) return;
+
+        if (isBot) {
+            botTimer += deltaTime;
+            if (botTimer >= BOT_MOVE_DELAY) {
+                botTimer = 0;
+                botStep();
+                changed = true;
+            }
+        }
+
+        elapsedTime += deltaTime;
+        if (elapsedTime >= delay && !isGameOver) {
+            softDrop();
+            elapsedTime = 0;
+            changed = true;
+        }
+    }
+
+    // Оценка стакана после фиксации фигуры: меньше высоты, дыр и перепадов
+    double evaluate(const Tetromino& piece) const {
+        std::vector<std::vector<bool>> grid(FIELD_HEIGHT, std::vector<bool>(FIELD_WIDTH));
+        for (int i = 0; i < FIELD_HEIGHT; ++i) {
+            for (int j = 0; j < FIELD_WIDTH; ++j) {
+                grid[i][j] = field[i][j] != sf::Color::Black;
+            }
+        }
+        for (size_t i = 0; i < piece.shape.size(); ++i) {
+            for (size_t j = 0; j < piece.shape[i].size(); ++j) {
+                if (piece.shape[i][j] != 0 && piece.y + (int)i >= 0) {
+                    grid[piece.y + i][piece.x + j] = true;
+                }
+            }
+        }
+
+        int lines = 0;
+        for (int i = FIELD_HEIGHT - 1; i >= 0; --i) {
+            if (std::find(grid[i].begin(), grid[i].end(), false) == grid[i].end()) {
+                grid.erase(grid.begin() + i);
+                grid.insert(grid.begin(), std::vector<bool>(FIELD_WIDTH));
+                ++lines;
+                ++i;
+            }
+        }
+
+        int totalHeight = 0, holes = 0, bumpiness = 0, prevHeight = -1;
+        for (int j = 0; j < FIELD_WIDTH; ++j) {
+            int height = 0;
+            for (int i = 0; i < FIELD_HEIGHT; ++i) {
+                if (grid[i][j]) {
+                    if (height == 0) height = FIELD_HEIGHT - i;
+                } else if (height > 0) {
+                    ++holes;
+                }
+            }
+            totalHeight += height;
+            if (prevHeight >= 0) bumpiness += std::abs(height - prevHeight);
+            prevHeight = height;
+        }
+
+        return 0.76 * lines - 0.51 * totalHeight - 0.36 * holes - 0.18 * bumpiness;
+    }
+
+    // Перебираем повороты и колонки, роняем фигуру и выбираем лучшую позицию
+    void planBotMove() {
+        double bestScore = -1e9;
+        botTargetX = currentPiece.x;
+        botRotations = 0;
+
+        Tetromino piece = currentPiece;
+        for (int rotation = 0; rotation < 4; ++rotation) {
+            for (int x = -3; x < FIELD_WIDTH; ++x) {
+                Tetromino test = piece;
+                test.x = x;
+                if (!fits(test)) continue;
+
+                while (fits(test)) {
+                    test.y++;
+                }
+                test.y--;
+
+                double value = evaluate(test);
+                if (value > bestScore) {
+                    bestScore = value;
+                    botTargetX = x;
+                    botRotations = rotation;
+                }
+            }
+            piece.shape = rotateShape(piece.shape);
+        }
+    }
+
+    // Один шаг бота: повернуть, сдвинуть к цели или сбросить фигуру
+    void botStep() {
+        if (botRotations > 0) {
+            if (rotatePiece()) {
+                --botRotations;
+            }
+            else {
+                hardDrop();
+            }
+        }
+        else if (currentPiece.x != botTargetX) {
+            if (!movePiece(currentPiece.x < botTargetX ? 1 : -1)) {
+                hardDrop();
+            }
+        }
+        else {
+            hardDrop();
+        }
+    }
+};
+
+// Пул потоков, продвигающий доски на один тик параллельно.
+// Главный поток обрабатывает свою долю досок и ждёт остальные потоки,
+// поэтому между тиками доски принадлежат только главному потоку
+class BoardWorkers {
+private:
+    std::vector<std::thread> threads;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    std::vector<Board>* boards = nullptr;
+    size_t workerCount = 1;
+    float deltaTime = 0;
+    unsigned generation = 0;
+    size_t running = 0;
+    bool stopping = false;
+
+    void advance(size_t worker) {
+        for (size_t i = worker; i < boards->size(); i += workerCount) {
+            (*boards)[i].update(deltaTime);
+        }
+    }
+
+    // seen — поколение на момент запуска потока: уже пройденные тики
+    // не должны будить новые потоки после повторного start()
+    void workerLoop(size_t worker, unsigned seen) {
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                wake.wait(lock, [&] { return stopping || generation != seen; });
+                if (stopping) return;
+                seen = generation;
+            }
+
+            advance(worker);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (--running == 0) {
+                done.notify_one();
+            }
+        }
+    }
+
+public:
+    ~BoardWorkers() {
+        stop();
+    }
+
+    // На одном ядре дополнительные потоки не создаются вовсе
+    void start(size_t boardCount) {
+        stop();
+        size_t cores = std::max(1u, std::thread::hardware_concurrency());
+        workerCount = std::min(cores, std::max<size_t>(1, boardCount));
+        std::lock_guard<std::mutex> lock(mutex);
+        for (size_t i = 1; i < workerCount; ++i) {
+            threads.emplace_back(&BoardWorkers::workerLoop, this, i, generation);
+        }
+    }
+
+    void stop() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        threads.clear();
+        workerCount = 1;
+        stopping = false;
+    }
+
+    void step(std::vector<Board>& target, float dt) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            boards = &target;
+            deltaTime = dt;
+            running = threads.size();
+            ++generation;
+        }
+        wake.notify_all();
+
+        advance(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        done.wait(lock, [&] { return running == 0; });
+    }
+};
+
+class Game {
+private:
+    sf::RenderWindow window;
+    Board player;
     std::vector<GameResult> bestResults;
     bool isGameFinished;
     bool showResults;
@@ -49,16 +475,17 @@ private:
     sf::RectangleShape restartButton;
     sf::Text restartButtonText;
     sf::RectangleShape fieldBorder;
+    bool needsRedraw;
 
-    std::vector<Tetromino> pieces = {
-        { { {1, 1, 1, 1} }, sf::Color::Cyan, 0, 0 },
-        { { {1, 1}, {1, 1} }, sf::Color::Yellow, 0, 0 },
-        { { {0, 1, 0}, {1, 1, 1} }, sf::Color::Magenta, 0, 0 },
-        { { {1, 1, 0}, {0, 1, 1} }, sf::Color::Red, 0, 0 },
-        { { {0, 1, 1}, {1, 1, 0} }, sf::Color::Green, 0, 0 },
-        { { {1, 0, 0}, {1, 1, 1} }, sf::Color::Blue, 0, 0 },
-        { { {0, 0, 1}, {1, 1, 1} }, sf::Color(255, 165, 0), 0, 0 }
-    };
+    // Режим против ботов: доска 0 у игрока, остальные у ботов
+    bool inVersus;
+    bool isVersusOver;
+    int versusBoardCount;
+    int versusWinner;
+    float versusAccumulator;
+    std::vector<Board> boards;
+    std::mt19937 garbageGen;
+    BoardWorkers workers;
 
     void loadResults() {
         bestResults.clear();
@@ -124,7 +551,7 @@ private:
     void finishGame(const std::string& result) {
         if (!isGameFinished) {
             isGameFinished = true;
-            addResult(score, result);
+            addResult(player.score, result);
             inMainMenu = true;
         }
     }
@@ -144,13 +571,13 @@ private:
 
 public:
     Game() : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "Tetris"),
-             field(FIELD_HEIGHT, std::vector<sf::Color>(FIELD_WIDTH, sf::Color::Black)),
-             elapsedTime(0), delay(0.5f), score(0), 
-             isGameOver(false), isGameWon(false), isGameFinished(false),
+             player(std::random_device{}()), isGameFinished(false),
              showResults(false), isPaused(false), inMainMenu(true),
-             showRating(false), selectedMenuItem(0) {
+             showRating(false), selectedMenuItem(0), needsRedraw(true),
+             inVersus(false), isVersusOver(false), versusBoardCount(4),
+             versusWinner(-1), versusAccumulator(0) {
         
-        menuItems = {"Start Game", "View Rating", "Exit"};
+        menuItems = {"Start Game", "Versus Bots", "View Rating", "Exit"};
         
         // Проверяем и создаем файл результатов, если его нет
         std::ifstream checkFile("tetris_results.txt");
@@ -168,229 +595,280 @@ public:
     }
 
     void resetGame() {
-        field = std::vector<std::vector<sf::Color>>(FIELD_HEIGHT, std::vector<sf::Color>(FIELD_WIDTH, sf::Color::Black));
-        elapsedTime = 0;
-        delay = 0.5f;
-        score = 0;
-        isGameOver = false;
-        isGameWon = false;
+        player.reset();
         isGameFinished = false;
         isPaused = false;
-        spawnPiece();
+        needsRedraw = true;
+        checkFinished();
     }
 
-    void spawnPiece() {
-        static std::random_device rd;
-        static std::mt19937 gen(rd());
-        std::uniform_int_distribution<> dist(0, pieces.size() - 1);
-        
-        currentPiece = pieces[dist(gen)];
-        currentPiece.x = FIELD_WIDTH / 2 - currentPiece.shape[0].size() / 2;
-        currentPiece.y = 0;
-        
-        // Проверка на проигрыш (не можем разместить новую фигуру)
-        if (!isValidPosition()) {
-            isGameOver = true;
+    void checkFinished() {
+        if (player.isGameOver) {
             finishGame("LOSE");
         }
+        else if (player.isGameWon) {
+            finishGame("WIN");
+        }
+    }
 
-        // Проверка на победу (фигура выходит за верхнюю границу)
-        for (size_t i = 0; i < currentPiece.shape.size(); ++i) {
-            for (size_t j = 0; j < currentPiece.shape[i].size(); ++j) {
-                if (currentPiece.shape[i][j] == 0) continue;
-                
-                int newY = currentPiece.y + i;
-                if (newY < 0) {
-                    isGameWon = true;
-                    finishGame("WIN");
-                    return;
-                }
+    void startVersus() {
+        // Все доски и раздача мусора выводятся из одного зерна матча
+        unsigned seed = std::random_device{}();
+        workers.stop();
+        boards.clear();
+        for (int i = 0; i < versusBoardCount; ++i) {
+            boards.emplace_back(seed + i, i != 0);
+            boards.back().attackTarget = i; // первым получает мусор следующий по кругу
+        }
+        garbageGen.seed(seed);
+        versusAccumulator = 0;
+        versusWinner = -1;
+        isVersusOver = false;
+        isPaused = false;
+        inVersus = true;
+        inMainMenu = false;
+        needsRedraw = true;
+        workers.start(boards.size());
+    }
+
+    void leaveVersus() {
+        workers.stop();
+        boards.clear();
+        inVersus = false;
+        inMainMenu = true;
+    }
+
+    // Следующий живой соперник по кругу, -1 если таких нет.
+    // Прошлая цель тоже подходит, если в живых осталась только она
+    int nextOpponent(int from) {
+        int count = boards.size();
+        for (int step = 1; step <= count; ++step) {
+            int target = (boards[from].attackTarget + step) % count;
+            if (target != from && !boards[target].isGameOver) {
+                boards[from].attackTarget = target;
+                return target;
             }
         }
+        return -1;
     }
 
-    bool isValidPosition() {
-        for (size_t i = 0; i < currentPiece.shape.size(); ++i) {
-            for (size_t j = 0; j < currentPiece.shape[i].size(); ++j) {
-                if (currentPiece.shape[i][j] == 0) continue;
-                
-                int newX = currentPiece.x + j;
-                int newY = currentPiece.y + i;
-                
-                if (newX < 0 || newX >= FIELD_WIDTH || newY >= FIELD_HEIGHT) {
-                    return false;
-                }
-                
-                if (newY >= 0 && field[newY][newX] != sf::Color::Black) {
-                    return false;
+    // Мусор раздаётся в порядке номеров досок после того, как все доски
+    // завершили тик, поэтому исход матча не зависит от потоков
+    bool exchangeGarbage() {
+        bool sent = false;
+        std::uniform_int_distribution<> holeDist(0, FIELD_WIDTH - 1);
+        for (size_t i = 0; i < boards.size(); ++i) {
+            Board& from = boards[i];
+            if (from.garbageToSend == 0) continue;
+
+            int target = nextOpponent(i);
+            if (target >= 0) {
+                int hole = holeDist(garbageGen);
+                for (int k = 0; k < from.garbageToSend; ++k) {
+                    boards[target].pendingGarbage.push_back(hole);
                 }
+                sent = true;
             }
+            from.garbageToSend = 0;
         }
-        return true;
+        return sent;
     }
 
-    void rotatePiece() {
-        if (isGameOver || isGameWon || isPaused) return;
-        
-        std::vector<std::vector<int>> rotated(currentPiece.shape[0].size(), 
-                                     std::vector<int>(currentPiece.shape.size()));
-        
-        for (size_t i = 0; i < currentPiece.shape.size(); ++i) {
-            for (size_t j = 0; j < currentPiece.shape[i].size(); ++j) {
-                rotated[j][currentPiece.shape.size() - 1 - i] = currentPiece.shape[i][j];
+    void updateVersus(float deltaTime) {
+        if (isPaused || isVersusOver) return;
+
+        // Фиксированный шаг: после долгой паузы не догоняем больше полсекунды
+        versusAccumulator = std::min(versusAccumulator + deltaTime, 0.5f);
+        while (versusAccumulator >= VERSUS_TICK) {
+            workers.step(boards, VERSUS_TICK);
+            for (const auto& board : boards) {
+                if (board.changed) needsRedraw = true;
             }
+            if (exchangeGarbage()) needsRedraw = true;
+            versusAccumulator -= VERSUS_TICK;
         }
-        
-        auto oldShape = currentPiece.shape;
-        currentPiece.shape = rotated;
-        
-        if (!isValidPosition()) {
-            currentPiece.shape = oldShape;
-        }
-    }
 
-    void lockPiece() {
-        for (size_t i = 0; i < currentPiece.shape.size(); ++i) {
-            for (size_t j = 0; j < currentPiece.shape[i].size(); ++j) {
-                if (currentPiece.shape[i][j] == 0) continue;
-                
-                int fieldX = currentPiece.x + j;
-                int fieldY = currentPiece.y + i;
-                
-                if (fieldY >= 0) {
-                    field[fieldY][fieldX] = currentPiece.color;
-                }
+        int alive = 0;
+        for (size_t i = 0; i < boards.size(); ++i) {
+            if (!boards[i].isGameOver) {
+                ++alive;
+                versusWinner = i;
             }
         }
-        
-        checkLines();
-        spawnPiece();
+        if (alive <= 1) {
+            if (alive == 0) versusWinner = -1;
+            isVersusOver = true;
+            needsRedraw = true;
+        }
     }
 
-    void checkLines() {
-        for (int i = FIELD_HEIGHT - 1; i >= 0; --i) {
-            bool lineComplete = true;
-            for (int j = 0; j < FIELD_WIDTH; ++j) {
-                if (field[i][j] == sf::Color::Black) {
-                    lineComplete = false;
-                    break;
-                }
-            }
-            
-            if (lineComplete) {
-                field.erase(field.begin() + i);
-                field.insert(field.begin(), std::vector<sf::Color>(FIELD_WIDTH, sf::Color::Black));
-                score += 100;
-                delay *= 0.95f;
+    // Экран статичен: ничего не меняется без ввода пользователя
+    bool isIdle() const {
+        if (inMainMenu || showRating || isPaused) return true;
+        return inVersus ? isVersusOver : (player.isGameOver || player.isGameWon);
+    }
+
+    // SFML 2 не умеет ждать событие с таймаутом, поэтому между опросами
+    // очереди спим короткими интервалами, пока не истечёт timeout
+    bool waitEvent(sf::Event& event, sf::Time timeout) {
+        sf::Clock waitClock;
+        while (!window.pollEvent(event)) {
+            sf::Time left = timeout - waitClock.getElapsedTime();
+            if (left <= sf::Time::Zero) {
+                return false;
             }
+            sf::sleep(std::min(left, sf::milliseconds(10)));
         }
+        return true;
     }
 
     void handleInput() {
         sf::Event event;
         while (window.pollEvent(event)) {
-            if (event.type == sf::Event::Closed) {
-                window.close();
-            }
-            
-            if (event.type == sf::Event::KeyPressed) {
-                if (inMainMenu) {
-                    if (event.key.code == sf::Keyboard::Up) {
-                        selectedMenuItem = (selectedMenuItem - 1 + menuItems.size()) % menuItems.size();
+            processEvent(event);
+        }
+    }
+
+    void processEvent(const sf::Event& event) {
+        // Любое нажатие или изменение окна может поменять картинку
+        if (event.type == sf::Event::KeyPressed ||
+            event.type == sf::Event::MouseButtonPressed ||
+            event.type == sf::Event::Resized ||
+            event.type == sf::Event::GainedFocus) {
+            needsRedraw = true;
+        }
+
+        if (event.type == sf::Event::Closed) {
+            window.close();
+        }
+        
+        if (event.type == sf::Event::KeyPressed) {
+            if (inMainMenu) {
+                if (event.key.code == sf::Keyboard::Up) {
+                    selectedMenuItem = (selectedMenuItem - 1 + menuItems.size()) % menuItems.size();
+                }
+                else if (event.key.code == sf::Keyboard::Down) {
+                    selectedMenuItem = (selectedMenuItem + 1) % menuItems.size();
+                }
+                else if (selectedMenuItem == 1 && event.key.code == sf::Keyboard::Left) {
+                    versusBoardCount = std::max(MIN_VERSUS_BOARDS, versusBoardCount - 1);
+                }
+                else if (selectedMenuItem == 1 && event.key.code == sf::Keyboard::Right) {
+                    versusBoardCount = std::min(MAX_VERSUS_BOARDS, versusBoardCount + 1);
+                }
+                else if (event.key.code == sf::Keyboard::Enter) {
+                    if (selectedMenuItem == 0) { // Начать игру
+                        inMainMenu = false;
+                        resetGame();
                     }
-                    else if (event.key.code == sf::Keyboard::Down) {
-                        selectedMenuItem = (selectedMenuItem + 1) % menuItems.size();
+                    else if (selectedMenuItem == 1) { // Против ботов
+                        startVersus();
                     }
-                    else if (event.key.code == sf::Keyboard::Enter) {
-                        if (selectedMenuItem == 0) { // Начать игру
-                            inMainMenu = false;
-                            resetGame();
-                        }
-                        else if (selectedMenuItem == 1) { // Рейтинг
-                            showRating = true;
-                        }
-                        else if (selectedMenuItem == 2) { // Выход
-                            window.close();
-                        }
+                    else if (selectedMenuItem == 2) { // Рейтинг
+                        showRating = true;
                     }
-                }
-                else if (showRating) {
-                    if (event.key.code == sf::Keyboard::Escape || event.key.code == sf::Keyboard::Enter) {
-                        showRating = false;
+                    else if (selectedMenuItem == 3) { // Выход
+                        window.close();
                     }
                 }
-                else if (isGameOver || isGameWon) {
+            }
+            else if (showRating) {
+                if (event.key.code == sf::Keyboard::Escape || event.key.code == sf::Keyboard::Enter) {
+                    showRating = false;
+                }
+            }
+            else if (inVersus) {
+                Board& own = boards[0];
+                if (isVersusOver) {
                     if (event.key.code == sf::Keyboard::R) {
-                        inMainMenu = true;
+                        startVersus();
                     }
                     else if (event.key.code == sf::Keyboard::Escape) {
-                        inMainMenu = true;
+                        leaveVersus();
                     }
                 }
-                else {
-                    if (event.key.code == sf::Keyboard::Escape) {
-                        isPaused = !isPaused;
+                else if (event.key.code == sf::Keyboard::Escape) {
+                    isPaused = !isPaused;
+                }
+                else if (event.key.code == sf::Keyboard::R) {
+                    startVersus();
+                }
+                else if (!isPaused && !own.isGameOver) {
+                    if (event.key.code == sf::Keyboard::Left) {
+                        own.movePiece(-1);
                     }
-                    else if (event.key.code == sf::Keyboard::Tab) {
-                        showResults = !showResults;
+                    else if (event.key.code == sf::Keyboard::Right) {
+                        own.movePiece(1);
                     }
-                    else if (event.key.code == sf::Keyboard::R) {
-                        resetGame();
+                    else if (event.key.code == sf::Keyboard::Down) {
+                        own.softDrop();
+                    }
+                    else if (event.key.code == sf::Keyboard::Up) {
+                        own.rotatePiece();
                     }
-                    else if (!isPaused) {
-                        if (event.key.code == sf::Keyboard::Left) {
-                            currentPiece.x--;
-                            if (!isValidPosition()) currentPiece.x++;
-                        }
-                        else if (event.key.code == sf::Keyboard::Right) {
-                            currentPiece.x++;
-                            if (!isValidPosition()) currentPiece.x--;
-                        }
-                        else if (event.key.code == sf::Keyboard::Down) {
-                            currentPiece.y++;
-                            if (!isValidPosition()) {
-                                currentPiece.y--;
-                                lockPiece();
-                            }
-                        }
-                        else if (event.key.code == sf::Keyboard::Up) {
-                            rotatePiece();
-                        }
-                        else if (event.key.code == sf::Keyboard::Space) {
-                            while (isValidPosition()) {
-                                currentPiece.y++;
-                            }
-                            currentPiece.y--;
-                            lockPiece();
-                        }
+                    else if (event.key.code == sf::Keyboard::Space) {
+                        own.hardDrop();
                     }
                 }
             }
-            
-            // Обработка клика по кнопке "Заново"
-            if (event.type == sf::Event::MouseButtonPressed && 
-                event.mouseButton.button == sf::Mouse::Left &&
-                !inMainMenu && !showRating) {
-                
-                sf::Vector2i mousePos = sf::Mouse::getPosition(window);
-                if (restartButton.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
+            else if (player.isGameOver || player.isGameWon) {
+                if (event.key.code == sf::Keyboard::R) {
+                    inMainMenu = true;
+                }
+                else if (event.key.code == sf::Keyboard::Escape) {
+                    inMainMenu = true;
+                }
+            }
+            else {
+                if (event.key.code == sf::Keyboard::Escape) {
+                    isPaused = !isPaused;
+                }
+                else if (event.key.code == sf::Keyboard::Tab) {
+                    showResults = !showResults;
+                }
+                else if (event.key.code == sf::Keyboard::R) {
                     resetGame();
                 }
+                else if (!isPaused) {
+                    if (event.key.code == sf::Keyboard::Left) {
+                        player.movePiece(-1);
+                    }
+                    else if (event.key.code == sf::Keyboard::Right) {
+                        player.movePiece(1);
+                    }
+                    else if (event.key.code == sf::Keyboard::Down) {
+                        player.softDrop();
+                    }
+                    else if (event.key.code == sf::Keyboard::Up) {
+                        player.rotatePiece();
+                    }
+                    else if (event.key.code == sf::Keyboard::Space) {
+                        player.hardDrop();
+                    }
+                    checkFinished();
+                }
+            }
+        }
+        
+        // Обработка клика по кнопке "Заново"
+        if (event.type == sf::Event::MouseButtonPressed && 
+            event.mouseButton.button == sf::Mouse::Left &&
+            !inMainMenu && !showRating && !inVersus) {
+            
+            sf::Vector2i mousePos = sf::Mouse::getPosition(window);
+            if (restartButton.getGlobalBounds().contains(mousePos.x, mousePos.y)) {
+                resetGame();
             }
         }
     }
 
     void update(float deltaTime) {
-        if (inMainMenu || isGameOver || isGameWon || isPaused) return;
+        if (inMainMenu || player.isGameOver || player.isGameWon || isPaused) return;
         
-        elapsedTime += deltaTime;
-        if (elapsedTime >= delay) {
-            currentPiece.y++;
-            if (!isValidPosition()) {
-                currentPiece.y--;
-                lockPiece();
-            }
-            elapsedTime = 0;
+        player.update(deltaTime);
+        if (player.changed) {
+            needsRedraw = true;
+            checkFinished();
         }
     }
 
@@ -403,7 +881,11 @@ public:
         window.draw(title);
         
         for (size_t i = 0; i < menuItems.size(); ++i) {
-            sf::Text item(menuItems[i], font, 30);
+            std::string label = menuItems[i];
+            if (i == 1) {
+                label += ": < " + std::to_string(versusBoardCount) + " >";
+            }
+            sf::Text item(label, font, 30);
             item.setPosition(WINDOW_WIDTH / 2 - item.getGlobalBounds().width / 2, 150 + i * 50);
             
             if (i == selectedMenuItem) {
@@ -416,7 +898,7 @@ public:
             window.draw(item);
         }
         
-        sf::Text hint("Use UP/DOWN arrows to select, ENTER to confirm", font, 16);
+        sf::Text hint("UP/DOWN: select, LEFT/RIGHT: boards, ENTER: confirm", font, 16);
         hint.setPosition(WINDOW_WIDTH / 2 - hint.getGlobalBounds().width / 2, WINDOW_HEIGHT - 50);
         hint.setFillColor(sf::Color(150, 150, 150));
         window.draw(hint);
@@ -459,47 +941,136 @@ public:
         window.display();
     }
 
-    void renderGame() {
-        window.clear(sf::Color::Black);
-        
-        // Рисуем границу игрового поля
-        window.draw(fieldBorder);
-        
-        // Рисуем игровое поле
+    static void appendQuad(sf::VertexArray& vertices, float x, float y, float w, float h, sf::Color color) {
+        vertices.append(sf::Vertex(sf::Vector2f(x, y), color));
+        vertices.append(sf::Vertex(sf::Vector2f(x + w, y), color));
+        vertices.append(sf::Vertex(sf::Vector2f(x + w, y + h), color));
+        vertices.append(sf::Vertex(sf::Vector2f(x, y + h), color));
+    }
+
+    // Добавляет клетки стакана и текущей фигуры в общий массив вершин,
+    // чтобы все доски рисовались одним вызовом draw()
+    static void appendBoard(sf::VertexArray& vertices, const Board& board, float left, float top, float cellSize) {
+        // Проигравшая доска рисуется приглушённой
+        auto shade = [&](sf::Color color) {
+            if (board.isGameOver) {
+                color.r /= 3;
+                color.g /= 3;
+                color.b /= 3;
+            }
+            return color;
+        };
+
         for (int i = 0; i < FIELD_HEIGHT; ++i) {
             for (int j = 0; j < FIELD_WIDTH; ++j) {
-                if (field[i][j] != sf::Color::Black) {
-                    sf::RectangleShape cell(sf::Vector2f(CELL_SIZE - 1, CELL_SIZE - 1));
-                    cell.setPosition(j * CELL_SIZE, i * CELL_SIZE);
-                    cell.setFillColor(field[i][j]);
-                    window.draw(cell);
+                if (board.field[i][j] != sf::Color::Black) {
+                    appendQuad(vertices, left + j * cellSize, top + i * cellSize,
+                               cellSize - 1, cellSize - 1, shade(board.field[i][j]));
                 }
             }
         }
         
-        // Рисуем текущую фигуру (если игра не завершена победой)
-        if (!isGameWon) {
-            for (size_t i = 0; i < currentPiece.shape.size(); ++i) {
-                for (size_t j = 0; j < currentPiece.shape[i].size(); ++j) {
-                    if (currentPiece.shape[i][j] != 0) {
-                        int x = (currentPiece.x + j) * CELL_SIZE;
-                        int y = (currentPiece.y + i) * CELL_SIZE;
-                        
-                        if (y >= 0) {
-                            sf::RectangleShape cell(sf::Vector2f(CELL_SIZE - 1, CELL_SIZE - 1));
-                            cell.setPosition(x, y);
-                            cell.setFillColor(currentPiece.color);
-                            window.draw(cell);
-                        }
-                    }
+        // Текущая фигура (если игра не завершена победой)
+        if (board.isGameWon) return;
+        const Tetromino& piece = board.currentPiece;
+        for (size_t i = 0; i < piece.shape.size(); ++i) {
+            for (size_t j = 0; j < piece.shape[i].size(); ++j) {
+                if (piece.shape[i][j] != 0 && piece.y + (int)i >= 0) {
+                    appendQuad(vertices, left + (piece.x + j) * cellSize, top + (piece.y + i) * cellSize,
+                               cellSize - 1, cellSize - 1, shade(piece.color));
                 }
             }
         }
+    }
+
+    void renderVersus() {
+        window.clear(sf::Color::Black);
+
+        const float gap = 10;
+        const float labelHeight = 20;
+        int count = boards.size();
+
+        // Подбираем число рядов, при котором клетки получаются крупнее всего
+        int cols = count;
+        float cellSize = 0;
+        for (int rows = 1; rows <= count; ++rows) {
+            int c = (count + rows - 1) / rows;
+            float byWidth = (WINDOW_WIDTH - (c + 1) * gap) / (c * FIELD_WIDTH);
+            float byHeight = (WINDOW_HEIGHT - rows * (labelHeight + gap)) / (rows * FIELD_HEIGHT);
+            float size = std::min(byWidth, byHeight);
+            if (size > cellSize) {
+                cellSize = size;
+                cols = c;
+            }
+        }
+
+        float boardWidth = cellSize * FIELD_WIDTH;
+        float boardHeight = cellSize * FIELD_HEIGHT;
+        float offsetX = (WINDOW_WIDTH - cols * boardWidth - (cols - 1) * gap) / 2;
+
+        // Все рамки и клетки всех досок собираются в один массив вершин
+        sf::VertexArray cells(sf::Quads);
+        std::vector<sf::Text> labels;
+        for (int i = 0; i < count; ++i) {
+            float left = offsetX + (i % cols) * (boardWidth + gap);
+            float top = labelHeight + (i / cols) * (boardHeight + labelHeight + gap);
+            sf::Color frame = (i == 0) ? sf::Color::White : sf::Color(90, 90, 90);
+
+            appendQuad(cells, left - 1, top - 1, boardWidth + 2, 1, frame);
+            appendQuad(cells, left - 1, top + boardHeight, boardWidth + 2, 1, frame);
+            appendQuad(cells, left - 1, top, 1, boardHeight, frame);
+            appendQuad(cells, left + boardWidth, top, 1, boardHeight, frame);
+            appendBoard(cells, boards[i], left, top, cellSize);
+
+            std::string name = (i == 0) ? "YOU" : "BOT " + std::to_string(i);
+            sf::Text label(name + " " + std::to_string(boards[i].score), font, 14);
+            label.setPosition(left, top - labelHeight);
+            label.setFillColor(boards[i].isGameOver ? sf::Color(150, 150, 150) : frame);
+            labels.push_back(label);
+        }
+        window.draw(cells);
+        for (const auto& label : labels) {
+            window.draw(label);
+        }
+
+        std::string message;
+        if (isVersusOver) {
+            message = versusWinner == 0 ? "YOU WIN!"
+                    : versusWinner > 0 ? "BOT " + std::to_string(versusWinner) + " WINS"
+                    : "DRAW";
+            message += "\nR: Rematch  ESC: Menu";
+        }
+        else if (isPaused) {
+            message = "PAUSED\nPress ESC to continue";
+        }
+        if (!message.empty()) {
+            sf::Text messageText(message, font, 30);
+            messageText.setPosition(WINDOW_WIDTH / 2 - messageText.getGlobalBounds().width / 2,
+                                    WINDOW_HEIGHT / 2 - messageText.getGlobalBounds().height / 2);
+            messageText.setFillColor(sf::Color::Yellow);
+            messageText.setOutlineColor(sf::Color::Black);
+            messageText.setOutlineThickness(2);
+            window.draw(messageText);
+        }
+
+        window.display();
+    }
+
+    void renderGame() {
+        window.clear(sf::Color::Black);
+        
+        // Рисуем границу игрового поля
+        window.draw(fieldBorder);
+        
+        // Рисуем игровое поле и текущую фигуру
+        sf::VertexArray cells(sf::Quads);
+        appendBoard(cells, player, 0, 0, CELL_SIZE);
+        window.draw(cells);
         
         // Рисуем интерфейс
         if (font.loadFromFile("C:\\Windows\\Fonts\\Arial.ttf")) {
             // Текущие показатели
-            sf::Text scoreText("Score: " + std::to_string(score), font, 20);
+            sf::Text scoreText("Score: " + std::to_string(player.score), font, 20);
             scoreText.setPosition(FIELD_WIDTH * CELL_SIZE + 20, 20);
             scoreText.setFillColor(sf::Color::White);
             window.draw(scoreText);
@@ -517,16 +1088,16 @@ public:
             }
             
             // Сообщения о завершении игры
-            if (isGameOver) {
-                sf::Text gameOverText("GAME OVER\nScore: " + std::to_string(score) + 
+            if (player.isGameOver) {
+                sf::Text gameOverText("GAME OVER\nScore: " + std::to_string(player.score) + 
                                      "\nPress R to return to menu", font, 24);
                 gameOverText.setPosition(FIELD_WIDTH * CELL_SIZE + 20, 100);
                 gameOverText.setFillColor(sf::Color::Red);
                 window.draw(gameOverText);
             }
             
-            if (isGameWon) {
-                sf::Text winText("YOU WIN!\nScore: " + std::to_string(score) + 
+            if (player.isGameWon) {
+                sf::Text winText("YOU WIN!\nScore: " + std::to_string(player.score) + 
                                 "\nPress R to return to menu", font, 24);
                 winText.setPosition(FIELD_WIDTH * CELL_SIZE + 20, 100);
                 winText.setFillColor(sf::Color::Green);
@@ -580,15 +1151,47 @@ public:
             float deltaTime = clock.restart().asSeconds();
             handleInput();
             
-            if (inMainMenu) {
-                renderMainMenu();
-            } 
-            else if (showRating) {
-                renderRating();
+            if (inVersus) {
+                updateVersus(deltaTime);
             }
-            else {
+            else if (!inMainMenu && !showRating) {
                 update(deltaTime);
-                renderGame();
+            }
+
+            // Кадр перерисовывается только если что-то изменилось
+            if (needsRedraw && window.isOpen()) {
+                if (inMainMenu) {
+                    renderMainMenu();
+                } 
+                else if (showRating) {
+                    renderRating();
+                }
+                else if (inVersus) {
+                    renderVersus();
+                }
+                else {
+                    renderGame();
+                }
+                needsRedraw = false;
+            }
+
+            sf::Event event;
+            if (isIdle()) {
+                // Статичный экран: спим до следующего события
+                if (window.waitEvent(event)) {
+                    processEvent(event);
+                }
+                // Время ожидания не должно попасть в падение фигуры
+                clock.restart();
+            }
+            else {
+                // Идёт игра: ждём ввод, но не дольше следующего шага фигуры
+                float untilStep = inVersus ? VERSUS_TICK - versusAccumulator
+                                           : player.delay - player.elapsedTime;
+                sf::Time untilTick = sf::seconds(untilStep - clock.getElapsedTime().asSeconds());
+                if (waitEvent(event, untilTick)) {
+                    processEvent(event);
+                }
             }
         }
     }